@@ -7,6 +7,202 @@
 using namespace std;
 using namespace chrono;
 
+// ----------------  ----------------
+// ˳ , ,       .
+//   AA_STATS (/D AA_STATS  MSVC  -DAA_STATS),   STATS_* 
+#ifdef AA_STATS
+#include <atomic>
+#include <mutex>
+#include <memory>
+#include <cstdint>
+#include <algorithm>
+
+namespace stats {
+    enum Op { OP_SEARCH, OP_INSERT, OP_DELETE, OP_CLEAR, OP_UNION, OP_INTERSECTION,
+              OP_SET_DIFFERENCE, OP_SYM_DIFFERENCE, OP_IS_SUBSET, OP_COUNT };
+    const char* const OpNames[OP_COUNT] = { "Search", "Insert", "Delete", "Clear", "Union",
+                                            "Intersection", "SetDifference", "SymDifference", "IsSubset" };
+
+    //     HDR:  16  - ,    [2^k, 2^(k+1))
+    //   16  ,       1/16
+    const int SubBuckets = 16, Groups = 40, Buckets = SubBuckets * Groups;
+
+    inline int bucketOf(uint64_t ns) {
+        if (ns < SubBuckets) return (int)ns;
+        int msb = 4;
+        while (msb < 63 && (ns >> (msb + 1))) msb++;
+        int group = msb - 3;
+        if (group >= Groups) return Buckets - 1;
+        return group * SubBuckets + (int)((ns >> (msb - 4)) - SubBuckets);
+    }
+    inline uint64_t bucketLow(int b) {
+        int group = b / SubBuckets, sub = b % SubBuckets;
+        if (group == 0) return sub;
+        return (uint64_t)(SubBuckets + sub) << (group - 1);
+    }
+
+    //     -,   fetch_add  load + store
+    inline void bump(atomic<uint64_t>& c, uint64_t k = 1) {
+        c.store(c.load(memory_order_relaxed) + k, memory_order_relaxed);
+    }
+
+    struct OpCounters {
+        atomic<uint64_t> calls, visited, totalNs, maxNs;
+        atomic<uint64_t> latency[Buckets];
+    };
+    struct ThreadStats {
+        OpCounters ops[OP_COUNT];
+        atomic<uint64_t> allocations, deallocations;
+        ThreadStats() { reset(); }
+        void reset() {
+            for (auto& op : ops) {
+                op.calls = 0;
+                op.visited = 0;
+                op.totalNs = 0;
+                op.maxNs = 0;
+                for (auto& b : op.latency) b = 0;
+            }
+            allocations = 0;
+            deallocations = 0;
+        }
+    };
+
+    struct Registry {
+        mutex m;
+        vector<unique_ptr<ThreadStats>> threads;
+    };
+    inline Registry& registry() {
+        static Registry r;
+        return r;
+    }
+    // ˳  .       ,
+    //       
+    inline ThreadStats& local() {
+        thread_local ThreadStats* mine = nullptr;
+        if (!mine) {
+            Registry& r = registry();
+            lock_guard<mutex> lock(r.m);
+            r.threads.emplace_back(new ThreadStats());
+            mine = r.threads.back().get();
+        }
+        return *mine;
+    }
+
+    struct OpSnapshot {
+        uint64_t calls = 0, visited = 0, totalNs = 0, maxNs = 0;
+        vector<uint64_t> latency = vector<uint64_t>(Buckets, 0);
+
+        //   ,    q-  
+        uint64_t percentile(double q) const {
+            uint64_t rank = (uint64_t)(q * calls + 0.5), seen = 0;
+            for (int b = 0; b < Buckets; b++) {
+                seen += latency[b];
+                if (seen >= rank && seen > 0) return bucketLow(b);
+            }
+            return 0;
+        }
+    };
+    struct Snapshot {
+        OpSnapshot ops[OP_COUNT];
+        uint64_t allocations = 0, deallocations = 0;
+
+        void toJSON(ostream& out) const {
+            out << "{\n  \"allocations\": " << allocations << ",\n  \"deallocations\": " << deallocations
+                << ",\n  \"ops\": {";
+            for (int i = 0; i < OP_COUNT; i++) {
+                const OpSnapshot& op = ops[i];
+                out << (i ? ",\n" : "\n") << "    \"" << OpNames[i] << "\": { \"calls\": " << op.calls
+                    << ", \"visited\": " << op.visited
+                    << ", \"mean_ns\": " << (op.calls ? op.totalNs / op.calls : 0)
+                    << ", \"p50_ns\": " << op.percentile(0.5)
+                    << ", \"p90_ns\": " << op.percentile(0.9)
+                    << ", \"p99_ns\": " << op.percentile(0.99)
+                    << ", \"max_ns\": " << op.maxNs << " }";
+            }
+            out << "\n  }\n}\n";
+        }
+    };
+
+    //    
+    inline Snapshot snapshot() {
+        Snapshot s;
+        Registry& r = registry();
+        lock_guard<mutex> lock(r.m);
+        for (auto& t : r.threads) {
+            for (int i = 0; i < OP_COUNT; i++) {
+                s.ops[i].calls += t->ops[i].calls.load(memory_order_relaxed);
+                s.ops[i].visited += t->ops[i].visited.load(memory_order_relaxed);
+                s.ops[i].totalNs += t->ops[i].totalNs.load(memory_order_relaxed);
+                s.ops[i].maxNs = max(s.ops[i].maxNs, t->ops[i].maxNs.load(memory_order_relaxed));
+                for (int b = 0; b < Buckets; b++) s.ops[i].latency[b] += t->ops[i].latency[b].load(memory_order_relaxed);
+            }
+            s.allocations += t->allocations.load(memory_order_relaxed);
+            s.deallocations += t->deallocations.load(memory_order_relaxed);
+        }
+        return s;
+    }
+    // ,      ,  
+    inline void reset() {
+        Registry& r = registry();
+        lock_guard<mutex> lock(r.m);
+        for (auto& t : r.threads) t->reset();
+    }
+    inline void dumpJSON(const string& filename) {
+        ofstream fout(filename);
+        snapshot().toJSON(fout);
+    }
+
+    //         .  
+    //   :     ,   
+    //    visited 
+    class ScopedOp {
+        Op op;
+        bool outer;
+        uint64_t visited = 0;
+        chrono::steady_clock::time_point start;
+
+        static ScopedOp*& active() {
+            thread_local ScopedOp* current = nullptr;
+            return current;
+        }
+    public:
+        explicit ScopedOp(Op o) : op(o), outer(active() == nullptr) {
+            if (outer) {
+                active() = this;
+                start = chrono::steady_clock::now();
+            }
+        }
+        ScopedOp(const ScopedOp&) = delete;
+        ScopedOp& operator=(const ScopedOp&) = delete;
+        ~ScopedOp() {
+            if (!outer) return;
+            uint64_t ns = (uint64_t)chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - start).count();
+            OpCounters& c = local().ops[op];
+            bump(c.calls);
+            bump(c.visited, visited);
+            bump(c.totalNs, ns);
+            bump(c.latency[bucketOf(ns)]);
+            if (ns > c.maxNs.load(memory_order_relaxed)) c.maxNs.store(ns, memory_order_relaxed);
+            active() = nullptr;
+        }
+        void visit(uint64_t k = 1) { active()->visited += k; }
+    };
+}
+
+#define STATS_OP(op) stats::ScopedOp stats_scope(stats::op)
+#define STATS_VISIT(k) stats_scope.visit(k)
+#define STATS_ALLOC(k) stats::bump(stats::local().allocations, k)
+#define STATS_FREE(k) stats::bump(stats::local().deallocations, k)
+//     c     
+#define STATS_FREED(c, ...) do { size_t stats_before = (c).size(); __VA_ARGS__; STATS_FREE(stats_before - (c).size()); } while (0)
+#else
+#define STATS_OP(op)
+#define STATS_VISIT(k)
+#define STATS_ALLOC(k)
+#define STATS_FREE(k)
+#define STATS_FREED(c, ...) __VA_ARGS__
+#endif
+
 class Set {
 private:
     struct Node {
@@ -21,9 +217,22 @@ private:
     size_t count;
     string name;
 
+    //      Clear (   )
+    void clearImpl() {
+        STATS_FREE(count);
+        Node* curr = head;
+        while (curr) {
+            Node* tmp = curr;
+            curr = curr->next;
+            delete tmp;
+        }
+        head = tail = nullptr;
+        count = 0;
+    }
+
 public:
     Set(const string& setName = "Set") : head(nullptr), tail(nullptr), count(0), name(setName) {}
-    ~Set() { Clear(); }
+    ~Set() { clearImpl(); }
 
     //   (       )
     Set(const Set&) = delete;
@@ -40,7 +249,7 @@ public:
     //   
     Set& operator=(Set&& other) noexcept {
         if (this != &other) {
-            Clear();
+            clearImpl();
             head = other.head;
             tail = other.tail;
             count = other.count;
@@ -55,8 +264,10 @@ public:
 
     // ,    
     bool Search(double x) const {
+        STATS_OP(OP_SEARCH);
         Node* curr = head;
         while (curr) {
+            STATS_VISIT(1);
             if (curr->value == x) return true;
             if (curr->value > x) return false; //  
             curr = curr->next;
@@ -66,28 +277,33 @@ public:
 
     //    
     bool Insert(double x) {
+        STATS_OP(OP_INSERT);
         if (Search(x)) return false; //   
 
         if (!head) { //   
             head = tail = new Node(x);
+            STATS_ALLOC(1);
             ++count;
             return true;
         }
 
         Node* curr = head;
         while (curr && curr->value < x) {
+            STATS_VISIT(1);
             curr = curr->next;
         }
 
         if (!curr) {
             //   
             Node* node = new Node(x);
+            STATS_ALLOC(1);
             tail->next = node;
             node->prev = tail;
             tail = node;
         }
         else {
             Node* node = new Node(x);
+            STATS_ALLOC(1);
             node->next = curr;
             node->prev = curr->prev;
             if (curr->prev) curr->prev->next = node;
@@ -100,10 +316,12 @@ public:
 
     //  
     bool Delete(double x) {
+        STATS_OP(OP_DELETE);
         if (!Search(x)) return false; //    -   
 
         Node* curr = head;
         while (curr) {
+            STATS_VISIT(1);
             if (curr->value == x) {
                 if (curr->prev) curr->prev->next = curr->next;
                 else head = curr->next;
@@ -112,6 +330,7 @@ public:
                 else tail = curr->prev;
 
                 delete curr;
+                STATS_FREE(1);
                 --count;
                 return true;
             }
@@ -137,18 +356,13 @@ public:
 
     //  
     void Clear() {
-        Node* curr = head;
-        while (curr) {
-            Node* tmp = curr;
-            curr = curr->next;
-            delete tmp;
-        }
-        head = tail = nullptr;
-        count = 0;
+        STATS_OP(OP_CLEAR);
+        clearImpl();
     }
 
     // ' 
     static Set Union(const Set& A, const Set& B, const string& name = "Union") {
+        STATS_OP(OP_UNION);
         Set result(name);
 
         //     
@@ -171,6 +385,7 @@ public:
 
     //  
     static Set Intersection(const Set& A, const Set& B, const string& name = "Intersection") {
+        STATS_OP(OP_INTERSECTION);
         Set result(name);
 
         Node* currA = A.head;
@@ -185,6 +400,7 @@ public:
 
     // г 
     static Set SetDifference(const Set& A, const Set& B, const string& name = "Difference") {
+        STATS_OP(OP_SET_DIFFERENCE);
         Set result(name);
 
         Node* currA = A.head;
@@ -199,6 +415,7 @@ public:
 
     //   
     static Set SymDifference(const Set& A, const Set& B, const string& name = "SymDifference") {
+        STATS_OP(OP_SYM_DIFFERENCE);
         Set diff1 = Set::SetDifference(A, B, "diff1"); // A\B
         Set diff2 = Set::SetDifference(B, A, "diff2"); //B\A
         Set result = Set::Union(diff1, diff2, name);
@@ -207,6 +424,7 @@ public:
 
     //      ?
     static bool IsSubset(const Set& A, const Set& B) {
+        STATS_OP(OP_IS_SUBSET);
         Node* currA = A.head;
         while (currA) {
             if (!B.Search(currA->value)) {
@@ -310,5 +528,9 @@ int main() {
     }
 
     fout.close();
+
+#ifdef AA_STATS
+    stats::dumpJSON("stats.json");
+#endif
     return 0;
 }
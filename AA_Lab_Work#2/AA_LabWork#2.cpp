@@ -4,7 +4,352 @@
 #include <utility>
 #include <random>
 #include <fstream>
+#include <tuple>
+#include <algorithm>
+#include <numeric>
+#include <chrono>
 using namespace std;
+using namespace chrono;
+
+// ----------------  ----------------
+// ˳ , ,       .
+//   AA_STATS (/D AA_STATS  MSVC  -DAA_STATS),   STATS_* 
+#ifdef AA_STATS
+#include <atomic>
+#include <mutex>
+#include <memory>
+#include <cstdint>
+#include <algorithm>
+
+namespace stats {
+    enum Op { OP_ADD_VERTEX, OP_REMOVE_VERTEX, OP_ADD_EDGE, OP_REMOVE_EDGE, OP_ADD_EDGES, OP_REMOVE_EDGES,
+              OP_REMOVE_VERTICES, OP_TO_ADJ_MATRIX, OP_FROM_ADJ_MATRIX, OP_TO_CSR, OP_APPLY_PERMUTATION, OP_COUNT };
+    const char* const OpNames[OP_COUNT] = { "addVertex", "removeVertex", "addEdge", "removeEdge", "addEdges",
+                                            "removeEdges", "removeVertices", "toAdjMatrix", "fromAdjMatrix",
+                                            "toCSR", "applyPermutation" };
+
+    //     HDR:  16  - ,    [2^k, 2^(k+1))
+    //   16  ,       1/16
+    const int SubBuckets = 16, Groups = 40, Buckets = SubBuckets * Groups;
+
+    inline int bucketOf(uint64_t ns) {
+        if (ns < SubBuckets) return (int)ns;
+        int msb = 4;
+        while (msb < 63 && (ns >> (msb + 1))) msb++;
+        int group = msb - 3;
+        if (group >= Groups) return Buckets - 1;
+        return group * SubBuckets + (int)((ns >> (msb - 4)) - SubBuckets);
+    }
+    inline uint64_t bucketLow(int b) {
+        int group = b / SubBuckets, sub = b % SubBuckets;
+        if (group == 0) return sub;
+        return (uint64_t)(SubBuckets + sub) << (group - 1);
+    }
+
+    //     -,   fetch_add  load + store
+    inline void bump(atomic<uint64_t>& c, uint64_t k = 1) {
+        c.store(c.load(memory_order_relaxed) + k, memory_order_relaxed);
+    }
+
+    struct OpCounters {
+        atomic<uint64_t> calls, visited, totalNs, maxNs;
+        atomic<uint64_t> latency[Buckets];
+    };
+    struct ThreadStats {
+        OpCounters ops[OP_COUNT];
+        atomic<uint64_t> allocations, deallocations;
+        ThreadStats() { reset(); }
+        void reset() {
+            for (auto& op : ops) {
+                op.calls = 0;
+                op.visited = 0;
+                op.totalNs = 0;
+                op.maxNs = 0;
+                for (auto& b : op.latency) b = 0;
+            }
+            allocations = 0;
+            deallocations = 0;
+        }
+    };
+
+    struct Registry {
+        mutex m;
+        vector<unique_ptr<ThreadStats>> threads;
+    };
+    inline Registry& registry() {
+        static Registry r;
+        return r;
+    }
+    // ˳  .       ,
+    //       
+    inline ThreadStats& local() {
+        thread_local ThreadStats* mine = nullptr;
+        if (!mine) {
+            Registry& r = registry();
+            lock_guard<mutex> lock(r.m);
+            r.threads.emplace_back(new ThreadStats());
+            mine = r.threads.back().get();
+        }
+        return *mine;
+    }
+
+    struct OpSnapshot {
+        uint64_t calls = 0, visited = 0, totalNs = 0, maxNs = 0;
+        vector<uint64_t> latency = vector<uint64_t>(Buckets, 0);
+
+        //   ,    q-  
+        uint64_t percentile(double q) const {
+            uint64_t rank = (uint64_t)(q * calls + 0.5), seen = 0;
+            for (int b = 0; b < Buckets; b++) {
+                seen += latency[b];
+                if (seen >= rank && seen > 0) return bucketLow(b);
+            }
+            return 0;
+        }
+    };
+    struct Snapshot {
+        OpSnapshot ops[OP_COUNT];
+        uint64_t allocations = 0, deallocations = 0;
+
+        void toJSON(ostream& out) const {
+            out << "{\n  \"allocations\": " << allocations << ",\n  \"deallocations\": " << deallocations
+                << ",\n  \"ops\": {";
+            for (int i = 0; i < OP_COUNT; i++) {
+                const OpSnapshot& op = ops[i];
+                out << (i ? ",\n" : "\n") << "    \"" << OpNames[i] << "\": { \"calls\": " << op.calls
+                    << ", \"visited\": " << op.visited
+                    << ", \"mean_ns\": " << (op.calls ? op.totalNs / op.calls : 0)
+                    << ", \"p50_ns\": " << op.percentile(0.5)
+                    << ", \"p90_ns\": " << op.percentile(0.9)
+                    << ", \"p99_ns\": " << op.percentile(0.99)
+                    << ", \"max_ns\": " << op.maxNs << " }";
+            }
+            out << "\n  }\n}\n";
+        }
+    };
+
+    //    
+    inline Snapshot snapshot() {
+        Snapshot s;
+        Registry& r = registry();
+        lock_guard<mutex> lock(r.m);
+        for (auto& t : r.threads) {
+            for (int i = 0; i < OP_COUNT; i++) {
+                s.ops[i].calls += t->ops[i].calls.load(memory_order_relaxed);
+                s.ops[i].visited += t->ops[i].visited.load(memory_order_relaxed);
+                s.ops[i].totalNs += t->ops[i].totalNs.load(memory_order_relaxed);
+                s.ops[i].maxNs = max(s.ops[i].maxNs, t->ops[i].maxNs.load(memory_order_relaxed));
+                for (int b = 0; b < Buckets; b++) s.ops[i].latency[b] += t->ops[i].latency[b].load(memory_order_relaxed);
+            }
+            s.allocations += t->allocations.load(memory_order_relaxed);
+            s.deallocations += t->deallocations.load(memory_order_relaxed);
+        }
+        return s;
+    }
+    // ,      ,  
+    inline void reset() {
+        Registry& r = registry();
+        lock_guard<mutex> lock(r.m);
+        for (auto& t : r.threads) t->reset();
+    }
+    inline void dumpJSON(const string& filename) {
+        ofstream fout(filename);
+        snapshot().toJSON(fout);
+    }
+
+    //         .  
+    //   :     ,   
+    //    visited 
+    class ScopedOp {
+        Op op;
+        bool outer;
+        uint64_t visited = 0;
+        chrono::steady_clock::time_point start;
+
+        static ScopedOp*& active() {
+            thread_local ScopedOp* current = nullptr;
+            return current;
+        }
+    public:
+        explicit ScopedOp(Op o) : op(o), outer(active() == nullptr) {
+            if (outer) {
+                active() = this;
+                start = chrono::steady_clock::now();
+            }
+        }
+        ScopedOp(const ScopedOp&) = delete;
+        ScopedOp& operator=(const ScopedOp&) = delete;
+        ~ScopedOp() {
+            if (!outer) return;
+            uint64_t ns = (uint64_t)chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - start).count();
+            OpCounters& c = local().ops[op];
+            bump(c.calls);
+            bump(c.visited, visited);
+            bump(c.totalNs, ns);
+            bump(c.latency[bucketOf(ns)]);
+            if (ns > c.maxNs.load(memory_order_relaxed)) c.maxNs.store(ns, memory_order_relaxed);
+            active() = nullptr;
+        }
+        void visit(uint64_t k = 1) { active()->visited += k; }
+    };
+}
+
+#define STATS_OP(op) stats::ScopedOp stats_scope(stats::op)
+#define STATS_VISIT(k) stats_scope.visit(k)
+#define STATS_ALLOC(k) stats::bump(stats::local().allocations, k)
+#define STATS_FREE(k) stats::bump(stats::local().deallocations, k)
+//     c     
+#define STATS_FREED(c, ...) do { size_t stats_before = (c).size(); __VA_ARGS__; STATS_FREE(stats_before - (c).size()); } while (0)
+#else
+#define STATS_OP(op)
+#define STATS_VISIT(k)
+#define STATS_ALLOC(k)
+#define STATS_FREE(k)
+#define STATS_FREED(c, ...) __VA_ARGS__
+#endif
+
+inline int targetOf(int v) { return v; }
+inline int targetOf(const pair<int, int>& p) { return p.first; }
+
+//    - ( )   .
+//   ;   u -  grouped[start[u] .. start[u + 1])
+template <typename T>
+void groupBySource(int n, const vector<pair<int, T>>& arcs, vector<int>& start, vector<T>& grouped) {
+    start.assign(n + 2, 0);
+    for (const auto& a : arcs) {
+        int v = targetOf(a.second);
+        if (a.first < 1 || a.first > n || v < 1 || v > n) continue;
+        start[a.first + 1]++;
+    }
+    for (int u = 1; u <= n; u++) start[u + 1] += start[u];
+    grouped.resize(start[n + 1]);
+    vector<int> pos(start.begin(), start.end() - 1);
+    for (const auto& a : arcs) {
+        int v = targetOf(a.second);
+        if (a.first < 1 || a.first > n || v < 1 || v > n) continue;
+        grouped[pos[a.first]++] = a.second;
+    }
+}
+
+// ----------------   ----------------
+//    CSR-:  u - targets[offsets[u] .. offsets[u + 1]).
+//    perm[old] = new (  1, perm[0] = 0)
+
+vector<int> orderToPermutation(const vector<int>& order) {
+    vector<int> perm(order.size() + 1, 0);
+    for (int i = 0; i < (int)order.size(); i++) perm[order[i]] = i + 1;
+    return perm;
+}
+
+//   (inverse[new] = old); ,  perm    1..n  perm[0] = 0
+vector<int> inversePermutation(const vector<int>& perm, int n) {
+    if ((int)perm.size() != n + 1 || perm[0] != 0) return {};
+    vector<int> inverse(n + 1, 0);
+    for (int i = 1; i <= n; i++) {
+        if (perm[i] < 1 || perm[i] > n || inverse[perm[i]] != 0) return {};
+        inverse[perm[i]] = i;
+    }
+    return inverse;
+}
+
+//    : ""       
+vector<int> degreeSortPermutation(const vector<int>& offsets) {
+    int n = (int)offsets.size() - 2;
+    vector<int> order(n);
+    iota(order.begin(), order.end(), 1);
+    stable_sort(order.begin(), order.end(), [&offsets](int a, int b) {
+        return offsets[a + 1] - offsets[a] > offsets[b + 1] - offsets[b];
+    });
+    return orderToPermutation(order);
+}
+
+//  -:   ,     
+//  ,      
+vector<int> cuthillMcKeeOrder(const vector<int>& offsets, const vector<int>& targets) {
+    int n = (int)offsets.size() - 2;
+    auto byDegree = [&offsets](int a, int b) {
+        return offsets[a + 1] - offsets[a] < offsets[b + 1] - offsets[b];
+    };
+    vector<int> starts(n);
+    iota(starts.begin(), starts.end(), 1);
+    stable_sort(starts.begin(), starts.end(), byDegree);
+
+    vector<char> visited(n + 1, 0);
+    vector<int> order, nbrs;
+    order.reserve(n);
+    for (int s : starts) {
+        if (visited[s]) continue;
+        visited[s] = 1;
+        size_t head = order.size();
+        order.push_back(s);
+        while (head < order.size()) {
+            int u = order[head++];
+            nbrs.clear();
+            for (int k = offsets[u]; k < offsets[u + 1]; k++) {
+                int v = targets[k];
+                if (!visited[v]) {
+                    visited[v] = 1;
+                    nbrs.push_back(v);
+                }
+            }
+            stable_sort(nbrs.begin(), nbrs.end(), byDegree);
+            order.insert(order.end(), nbrs.begin(), nbrs.end());
+        }
+    }
+    return order;
+}
+
+//  - (RCM):     
+vector<int> rcmPermutation(const vector<int>& offsets, const vector<int>& targets) {
+    vector<int> order = cuthillMcKeeOrder(offsets, targets);
+    reverse(order.begin(), order.end());
+    return orderToPermutation(order);
+}
+
+//    ( Rabbit Order):    ,
+//           
+vector<int> communityPermutation(const vector<int>& offsets, const vector<int>& targets, int rounds = 10) {
+    int n = (int)offsets.size() - 2;
+    vector<int> label(n + 1), cnt(n + 1, 0), touched;
+    iota(label.begin(), label.end(), 0);
+    for (int r = 0; r < rounds; r++) {
+        bool changed = false;
+        for (int u = 1; u <= n; u++) {
+            if (offsets[u] == offsets[u + 1]) continue;
+            touched.clear();
+            for (int k = offsets[u]; k < offsets[u + 1]; k++) {
+                int l = label[targets[k]];
+                if (cnt[l]++ == 0) touched.push_back(l);
+            }
+            //    ;    ,   
+            int maxCnt = 0;
+            for (int l : touched) maxCnt = max(maxCnt, cnt[l]);
+            int best = label[u];
+            if (cnt[best] != maxCnt) {
+                best = n + 1;
+                for (int l : touched) {
+                    if (cnt[l] == maxCnt && l < best) best = l;
+                }
+            }
+            for (int l : touched) cnt[l] = 0;
+            if (best != label[u]) {
+                label[u] = best;
+                changed = true;
+            }
+        }
+        if (!changed) break;
+    }
+
+    vector<int> order = cuthillMcKeeOrder(offsets, targets);
+    vector<int> first(n + 1, -1); //      
+    for (int i = 0; i < n; i++) {
+        if (first[label[order[i]]] < 0) first[label[order[i]]] = i;
+    }
+    stable_sort(order.begin(), order.end(), [&label, &first](int a, int b) {
+        return first[label[a]] < first[label[b]];
+    });
+    return orderToPermutation(order);
+}
 
 //  
 class Graph {
@@ -12,29 +357,77 @@ protected:
     int n;
     vector<list<int>> AdjList;
     virtual void generate_ER(double p) = 0;
+
+    //   :          
+    // ( ,    std::list)       splice
+    void appendArcs(const vector<pair<int, int>>& arcs) {
+        STATS_OP(OP_ADD_EDGES);
+        vector<int> start, targets;
+        groupBySource(n, arcs, start, targets);
+        STATS_ALLOC(targets.size());
+        for (int u = 1; u <= n; u++) {
+            if (start[u] == start[u + 1]) continue;
+            list<int> chunk(targets.begin() + start[u], targets.begin() + start[u + 1]);
+            AdjList[u].splice(AdjList[u].end(), chunk);
+        }
+    }
+    //   :      
+    void eraseArcs(const vector<pair<int, int>>& arcs) {
+        STATS_OP(OP_REMOVE_EDGES);
+        vector<int> start, targets;
+        groupBySource(n, arcs, start, targets);
+        for (int u = 1; u <= n; u++) {
+            if (start[u] == start[u + 1]) continue;
+            auto first = targets.begin() + start[u], last = targets.begin() + start[u + 1];
+            sort(first, last);
+            STATS_VISIT(AdjList[u].size());
+            STATS_FREED(AdjList[u], AdjList[u].remove_if([first, last](int v) {return binary_search(first, last, v); }));
+        }
+    }
 public:
     Graph(int Vertices) : n(Vertices), AdjList(Vertices + 1) {}
     Graph(int Vertices, double p) : n(Vertices), AdjList(Vertices + 1) {
         generate_ER(p);
     }
-    virtual ~Graph() {}
+    virtual ~Graph() {
+        STATS_FREE(accumulate(AdjList.begin(), AdjList.end(), (size_t)0, [](size_t s, const auto& l) {return s + l.size(); }));
+    }
 
     void addVertex() {
+        STATS_OP(OP_ADD_VERTEX);
         AdjList.push_back(list<int>());
         n++;
     }
     void removeVertex(int v) {
+        STATS_OP(OP_REMOVE_VERTEX);
         if (v < 1 || v > n) return;
         for (int i = 1; i <= n; i++) {
-            if (i != v) AdjList[i].remove(v);
+            STATS_VISIT(AdjList[i].size());
+            if (i != v) STATS_FREED(AdjList[i], AdjList[i].remove(v));
+        }
+        STATS_FREED(AdjList[v], AdjList[v].clear());
+    }
+    //         (O(n+m)  O(k(n+m)))
+    void removeVertices(const vector<int>& vs) {
+        STATS_OP(OP_REMOVE_VERTICES);
+        vector<char> removed(n + 1, 0);
+        for (int v : vs) {
+            if (v >= 1 && v <= n) removed[v] = 1;
+        }
+        for (int i = 1; i <= n; i++) {
+            STATS_VISIT(AdjList[i].size());
+            if (removed[i]) STATS_FREED(AdjList[i], AdjList[i].clear());
+            else STATS_FREED(AdjList[i], AdjList[i].remove_if([&removed](int j) {return removed[j] != 0; }));
         }
-        AdjList[v].clear();
     }
     virtual void addEdge(int u, int v) = 0;
     virtual void removeEdge(int u, int v) = 0;
+    virtual void addEdges(const vector<pair<int, int>>& edges) = 0;
+    virtual void removeEdges(const vector<pair<int, int>>& edges) = 0;
     virtual void printGraph() const = 0;
 
     vector<vector<int>> toAdjMatrix() const {
+        STATS_OP(OP_TO_ADJ_MATRIX);
         vector<vector<int>> M(n + 1, vector<int>(n + 1, 0));
         for (int i = 1; i <= n; i++) {
             for (int j : AdjList[i]) {
@@ -44,12 +437,15 @@ public:
         return M;
     }
     void fromAdjMatrix(const vector<vector<int>>& M) {
+        STATS_OP(OP_FROM_ADJ_MATRIX);
+        STATS_FREE(accumulate(AdjList.begin(), AdjList.end(), (size_t)0, [](size_t s, const auto& l) {return s + l.size(); }));
         n = (int)M.size() - 1;
         AdjList.assign(n + 1, {});
         for (int i = 1; i <= n; i++) {
             for (int j = 1; j <= n; j++) {
                 if (M[i][j] != 0) {
                     AdjList[i].push_back(j);
+                    STATS_ALLOC(1);
                 }
             }
         }
@@ -64,6 +460,76 @@ public:
             cout << "\n";
         }
     }
+
+    // CSR-:   u - targets[offsets[u] .. offsets[u + 1])
+    void toCSR(vector<int>& offsets, vector<int>& targets) const {
+        STATS_OP(OP_TO_CSR);
+        offsets.assign(n + 2, 0);
+        for (int i = 1; i <= n; i++) offsets[i + 1] = offsets[i] + (int)AdjList[i].size();
+        targets.clear();
+        targets.reserve(offsets[n + 1]);
+        for (int i = 1; i <= n; i++) targets.insert(targets.end(), AdjList[i].begin(), AdjList[i].end());
+    }
+    //         
+    int bfsSweep() const {
+        vector<char> visited(n + 1, 0);
+        vector<int> queue;
+        queue.reserve(n);
+        for (int s = 1; s <= n; s++) {
+            if (visited[s]) continue;
+            visited[s] = 1;
+            size_t head = queue.size();
+            queue.push_back(s);
+            while (head < queue.size()) {
+                int u = queue[head++];
+                for (int v : AdjList[u]) {
+                    if (!visited[v]) {
+                        visited[v] = 1;
+                        queue.push_back(v);
+                    }
+                }
+            }
+        }
+        return (int)queue.size();
+    }
+    //     (perm[old] = new).     
+    //  ,         '.
+    // ϳ  toAdjMatrix  toCSR      .
+    //  perm    1..n  perm[0] = 0,      false
+    bool applyPermutation(const vector<int>& perm) {
+        STATS_OP(OP_APPLY_PERMUTATION);
+        vector<int> inverse = inversePermutation(perm, n);
+        if (inverse.empty()) return false;
+        vector<list<int>> renamed(n + 1);
+        for (int i = 1; i <= n; i++) {
+            for (int j : AdjList[inverse[i]]) renamed[i].push_back(perm[j]);
+            STATS_ALLOC(renamed[i].size());
+            STATS_FREE(renamed[i].size()); //   򳺿    
+        }
+        AdjList = move(renamed);
+        return true;
+    }
+    vector<int> reorderByDegree() {
+        vector<int> offsets, targets;
+        toCSR(offsets, targets);
+        vector<int> perm = degreeSortPermutation(offsets);
+        applyPermutation(perm);
+        return perm;
+    }
+    vector<int> reorderRCM() {
+        vector<int> offsets, targets;
+        toCSR(offsets, targets);
+        vector<int> perm = rcmPermutation(offsets, targets);
+        applyPermutation(perm);
+        return perm;
+    }
+    vector<int> reorderByCommunity() {
+        vector<int> offsets, targets;
+        toCSR(offsets, targets);
+        vector<int> perm = communityPermutation(offsets, targets);
+        applyPermutation(perm);
+        return perm;
+    }
 };
 
 // 
@@ -88,14 +554,34 @@ public:
     }
 
     void addEdge(int u, int v) override {
+        STATS_OP(OP_ADD_EDGE);
         if (u < 1 || u > n || v < 1 || v > n) return;
         AdjList[u].push_back(v);
         AdjList[v].push_back(u);
+        STATS_ALLOC(2);
     }
     void removeEdge(int u, int v) override {
+        STATS_OP(OP_REMOVE_EDGE);
         if (u < 1 || u > n || v < 1 || v > n) return;
-        AdjList[u].remove(v);
-        AdjList[v].remove(u);
+        STATS_VISIT(AdjList[u].size() + AdjList[v].size());
+        STATS_FREED(AdjList[u], AdjList[u].remove(v));
+        STATS_FREED(AdjList[v], AdjList[v].remove(u));
+    }
+    void addEdges(const vector<pair<int, int>>& edges) override {
+        appendArcs(bothDirections(edges));
+    }
+    void removeEdges(const vector<pair<int, int>>& edges) override {
+        eraseArcs(bothDirections(edges));
+    }
+    //    u-v   : u->v  v->u
+    static vector<pair<int, int>> bothDirections(const vector<pair<int, int>>& edges) {
+        vector<pair<int, int>> arcs;
+        arcs.reserve(2 * edges.size());
+        for (auto& e : edges) {
+            arcs.push_back(e);
+            arcs.push_back({ e.second, e.first });
+        }
+        return arcs;
     }
     void printGraph() const override {
         cout << "Undirected graph:\n";
@@ -143,12 +629,22 @@ public:
     }
 
     void addEdge(int u, int v) override {
+        STATS_OP(OP_ADD_EDGE);
         if (u < 1 || u > n || v < 1 || v > n) return;
         AdjList[u].push_back(v);
+        STATS_ALLOC(1);
     }
     void removeEdge(int u, int v) override {
+        STATS_OP(OP_REMOVE_EDGE);
         if (u < 1 || u > n || v < 1 || v > n) return;
-        AdjList[u].remove(v);
+        STATS_VISIT(AdjList[u].size());
+        STATS_FREED(AdjList[u], AdjList[u].remove(v));
+    }
+    void addEdges(const vector<pair<int, int>>& edges) override {
+        appendArcs(edges);
+    }
+    void removeEdges(const vector<pair<int, int>>& edges) override {
+        eraseArcs(edges);
     }
     void printGraph() const override {
         cout << "Directed graph:\n";
@@ -179,28 +675,77 @@ class WeightedGraph {
 protected:
     int n;
     vector<list<pair<int, int>>> AdjList;
+
+    //  :  u -> (v, w),      splice
+    void appendArcs(const vector<pair<int, pair<int, int>>>& arcs) {
+        STATS_OP(OP_ADD_EDGES);
+        vector<int> start;
+        vector<pair<int, int>> targets;
+        groupBySource(n, arcs, start, targets);
+        STATS_ALLOC(targets.size());
+        for (int u = 1; u <= n; u++) {
+            if (start[u] == start[u + 1]) continue;
+            list<pair<int, int>> chunk(targets.begin() + start[u], targets.begin() + start[u + 1]);
+            AdjList[u].splice(AdjList[u].end(), chunk);
+        }
+    }
+    //  :      
+    void eraseArcs(const vector<pair<int, int>>& arcs) {
+        STATS_OP(OP_REMOVE_EDGES);
+        vector<int> start, targets;
+        groupBySource(n, arcs, start, targets);
+        for (int u = 1; u <= n; u++) {
+            if (start[u] == start[u + 1]) continue;
+            auto first = targets.begin() + start[u], last = targets.begin() + start[u + 1];
+            sort(first, last);
+            STATS_VISIT(AdjList[u].size());
+            STATS_FREED(AdjList[u], AdjList[u].remove_if([first, last](pair<int, int> p) {return binary_search(first, last, p.first); }));
+        }
+    }
 public:
     WeightedGraph(int Vertices) : n(Vertices), AdjList(Vertices + 1) {}
-    virtual ~WeightedGraph() {}
+    virtual ~WeightedGraph() {
+        STATS_FREE(accumulate(AdjList.begin(), AdjList.end(), (size_t)0, [](size_t s, const auto& l) {return s + l.size(); }));
+    }
 
     void addVertex() {
+        STATS_OP(OP_ADD_VERTEX);
         AdjList.push_back(list<pair<int,int>>());
         n++;
     }
     void removeVertex(int v) {
+        STATS_OP(OP_REMOVE_VERTEX);
         if (v < 1 || v > n) return;
         for (int i = 1; i <= n; i++) {
+            STATS_VISIT(AdjList[i].size());
             if (i != v) {
-                AdjList[i].remove_if([v](pair<int, int> p) {return p.first == v;});
+                STATS_FREED(AdjList[i], AdjList[i].remove_if([v](pair<int, int> p) {return p.first == v;}));
             }
         }
-        AdjList[v].clear();
+        STATS_FREED(AdjList[v], AdjList[v].clear());
+    }
+    //        
+    void removeVertices(const vector<int>& vs) {
+        STATS_OP(OP_REMOVE_VERTICES);
+        vector<char> removed(n + 1, 0);
+        for (int v : vs) {
+            if (v >= 1 && v <= n) removed[v] = 1;
+        }
+        for (int i = 1; i <= n; i++) {
+            STATS_VISIT(AdjList[i].size());
+            if (removed[i]) STATS_FREED(AdjList[i], AdjList[i].clear());
+            else STATS_FREED(AdjList[i], AdjList[i].remove_if([&removed](pair<int, int> p) {return removed[p.first] != 0; }));
+        }
     }
     virtual void addEdge(int u, int v, int w) = 0;
     virtual void removeEdge(int u, int v) = 0;
+    //    (u, v, w)
+    virtual void addEdges(const vector<tuple<int, int, int>>& edges) = 0;
+    virtual void removeEdges(const vector<pair<int, int>>& edges) = 0;
     virtual void printGraph() const = 0;
 
     vector<vector<int>> toAdjMatrix() const {
+        STATS_OP(OP_TO_ADJ_MATRIX);
         vector<vector<int>> M(n + 1, vector<int>(n + 1, 0));
         for (int i = 1; i <= n; i++) {
             for (auto&p : AdjList[i]) {
@@ -211,12 +756,15 @@ public:
         return M;
     }
     void fromAdjMatrix(const vector<vector<int>>& M) {
+        STATS_OP(OP_FROM_ADJ_MATRIX);
+        STATS_FREE(accumulate(AdjList.begin(), AdjList.end(), (size_t)0, [](size_t s, const auto& l) {return s + l.size(); }));
         n = (int)M.size() - 1;
         AdjList.assign(n + 1, {});
         for (int i = 1; i <= n; i++) {
             for (int j = 1; j <= n; j++) {
                 if (M[i][j] != 0) {
                     AdjList[i].push_back({ j, M[i][j] });
+                    STATS_ALLOC(1);
                 }
             }
         }
@@ -231,6 +779,59 @@ public:
             cout << "\n";
         }
     }
+
+    // CSR-:  u -> targets[k]   weights[k], k  [offsets[u], offsets[u + 1])
+    void toCSR(vector<int>& offsets, vector<int>& targets, vector<int>& weights) const {
+        STATS_OP(OP_TO_CSR);
+        offsets.assign(n + 2, 0);
+        for (int i = 1; i <= n; i++) offsets[i + 1] = offsets[i] + (int)AdjList[i].size();
+        targets.clear();
+        weights.clear();
+        targets.reserve(offsets[n + 1]);
+        weights.reserve(offsets[n + 1]);
+        for (int i = 1; i <= n; i++) {
+            for (auto& p : AdjList[i]) {
+                targets.push_back(p.first);
+                weights.push_back(p.second);
+            }
+        }
+    }
+    //     (perm[old] = new),  .
+    //    Graph,       ; false -  perm
+    bool applyPermutation(const vector<int>& perm) {
+        STATS_OP(OP_APPLY_PERMUTATION);
+        vector<int> inverse = inversePermutation(perm, n);
+        if (inverse.empty()) return false;
+        vector<list<pair<int, int>>> renamed(n + 1);
+        for (int i = 1; i <= n; i++) {
+            for (auto& p : AdjList[inverse[i]]) renamed[i].push_back({ perm[p.first], p.second });
+            STATS_ALLOC(renamed[i].size());
+            STATS_FREE(renamed[i].size()); //   򳺿    
+        }
+        AdjList = move(renamed);
+        return true;
+    }
+    vector<int> reorderByDegree() {
+        vector<int> offsets, targets, weights;
+        toCSR(offsets, targets, weights);
+        vector<int> perm = degreeSortPermutation(offsets);
+        applyPermutation(perm);
+        return perm;
+    }
+    vector<int> reorderRCM() {
+        vector<int> offsets, targets, weights;
+        toCSR(offsets, targets, weights);
+        vector<int> perm = rcmPermutation(offsets, targets);
+        applyPermutation(perm);
+        return perm;
+    }
+    vector<int> reorderByCommunity() {
+        vector<int> offsets, targets, weights;
+        toCSR(offsets, targets, weights);
+        vector<int> perm = communityPermutation(offsets, targets);
+        applyPermutation(perm);
+        return perm;
+    }
 };
 
 //   
@@ -256,14 +857,37 @@ public:
     }
 
     void addEdge(int u, int v, int w) override {
+        STATS_OP(OP_ADD_EDGE);
         if (u < 1 || u > n || v < 1 || v > n) return;
         AdjList[u].push_back({ v, w });
         AdjList[v].push_back({ u, w });
+        STATS_ALLOC(2);
     }
     void removeEdge(int u, int v) override {
+        STATS_OP(OP_REMOVE_EDGE);
         if (u < 1 || u > n || v < 1 || v > n) return;
-        AdjList[u].remove_if([v](pair<int, int> p) {return p.first == v;});
-        AdjList[v].remove_if([u](pair<int, int> p) {return p.first == u; });
+        STATS_VISIT(AdjList[u].size() + AdjList[v].size());
+        STATS_FREED(AdjList[u], AdjList[u].remove_if([v](pair<int, int> p) {return p.first == v;}));
+        STATS_FREED(AdjList[v], AdjList[v].remove_if([u](pair<int, int> p) {return p.first == u; }));
+    }
+    void addEdges(const vector<tuple<int, int, int>>& edges) override {
+        vector<pair<int, pair<int, int>>> arcs;
+        arcs.reserve(2 * edges.size());
+        for (auto& e : edges) {
+            int u = get<0>(e), v = get<1>(e), w = get<2>(e);
+            arcs.push_back({ u, { v, w } });
+            arcs.push_back({ v, { u, w } });
+        }
+        appendArcs(arcs);
+    }
+    void removeEdges(const vector<pair<int, int>>& edges) override {
+        vector<pair<int, int>> arcs;
+        arcs.reserve(2 * edges.size());
+        for (auto& e : edges) {
+            arcs.push_back(e);
+            arcs.push_back({ e.second, e.first });
+        }
+        eraseArcs(arcs);
     }
     void printGraph() const override {
         cout << "graph:\n";
@@ -311,12 +935,27 @@ public:
     }
 
     void addEdge(int u, int v, int w) override {
+        STATS_OP(OP_ADD_EDGE);
         if (u < 1 || u > n || v < 1 || v > n) return;
         AdjList[u].push_back({ v, w });
+        STATS_ALLOC(1);
     }
     void removeEdge(int u, int v) override {
+        STATS_OP(OP_REMOVE_EDGE);
         if (u < 1 || u > n || v < 1 || v > n) return;
-        AdjList[u].remove_if([v](pair<int, int> p) {return p.first == v; });
+        STATS_VISIT(AdjList[u].size());
+        STATS_FREED(AdjList[u], AdjList[u].remove_if([v](pair<int, int> p) {return p.first == v; }));
+    }
+    void addEdges(const vector<tuple<int, int, int>>& edges) override {
+        vector<pair<int, pair<int, int>>> arcs;
+        arcs.reserve(edges.size());
+        for (auto& e : edges) {
+            arcs.push_back({ get<0>(e), { get<1>(e), get<2>(e) } });
+        }
+        appendArcs(arcs);
+    }
+    void removeEdges(const vector<pair<int, int>>& edges) override {
+        eraseArcs(edges);
     }
     void printGraph() const override {
         cout << "Weighted directed graph:\n";
@@ -341,6 +980,77 @@ public:
     }
 };
 
+// ----------------   ----------------
+//       CSR;    
+int bfsSweep(const vector<int>& offsets, const vector<int>& targets) {
+    int n = (int)offsets.size() - 2;
+    vector<char> visited(n + 1, 0);
+    vector<int> queue;
+    queue.reserve(n);
+    for (int s = 1; s <= n; s++) {
+        if (visited[s]) continue;
+        visited[s] = 1;
+        size_t head = queue.size();
+        queue.push_back(s);
+        while (head < queue.size()) {
+            int u = queue[head++];
+            for (int k = offsets[u]; k < offsets[u + 1]; k++) {
+                if (!visited[targets[k]]) {
+                    visited[targets[k]] = 1;
+                    queue.push_back(targets[k]);
+                }
+            }
+        }
+    }
+    return (int)queue.size();
+}
+
+//  PageRank (pull):     ,   rank    .
+//       CSR,       ;
+//      
+double pageRankSweep(const vector<int>& offsets, const vector<int>& targets, int iterations) {
+    int n = (int)offsets.size() - 2;
+    if (n <= 0) return 0;
+    vector<double> rank(n + 1, 1.0 / n), next(n + 1, 0.0);
+    for (int it = 0; it < iterations; it++) {
+        for (int u = 1; u <= n; u++) {
+            double s = 0;
+            for (int k = offsets[u]; k < offsets[u + 1]; k++) {
+                int v = targets[k], deg = offsets[v + 1] - offsets[v];
+                if (deg > 0) s += rank[v] / deg;
+            }
+            next[u] = 0.15 / n + 0.85 * s;
+        }
+        swap(rank, next);
+    }
+    return rank[1];
+}
+
+//   ()  repeats    
+template <typename F>
+double medianTime(F run, int repeats) {
+    run();
+    vector<double> times;
+    for (int r = 0; r < repeats; r++) {
+        auto start = steady_clock::now();
+        run();
+        auto end = steady_clock::now();
+        times.push_back(duration<double, milli>(end - start).count());
+    }
+    sort(times.begin(), times.end());
+    return times[repeats / 2];
+}
+
+//   |u - v|     -      '
+double averageGap(const vector<int>& offsets, const vector<int>& targets) {
+    int n = (int)offsets.size() - 2;
+    double sum = 0;
+    for (int u = 1; u <= n; u++) {
+        for (int k = offsets[u]; k < offsets[u + 1]; k++) sum += abs(u - targets[k]);
+    }
+    return targets.empty() ? 0 : sum / targets.size();
+}
+
 int main()
 {
     UndirectedGraph UDG_1(6);
@@ -407,4 +1117,72 @@ int main()
     WeightedDirectedGraph WDG_8_ER(15, 0.9, 1, 15);
     WDG_8_ER.printGraph();
     WDG_8_ER.exportToDOT("WDG_8_ER.dot");
+
+    //  
+    UndirectedGraph UDG_9(8);
+    UDG_9.addEdges({ {1, 2}, {1, 3}, {2, 4}, {3, 4}, {5, 6}, {6, 7}, {7, 8} });
+    UDG_9.printGraph();
+    UDG_9.removeEdges({ {1, 3}, {6, 7} });
+    UDG_9.removeVertices({ 2, 8 });
+    UDG_9.printGraph();
+
+    WeightedDirectedGraph WDG_10(6);
+    WDG_10.addEdges({ make_tuple(1, 2, 4), make_tuple(1, 3, 2), make_tuple(3, 4, 7), make_tuple(5, 6, 1) });
+    WDG_10.removeEdges({ {1, 2} });
+    WDG_10.removeVertices({ 5 });
+    WDG_10.printGraph();
+
+    //  
+    UndirectedGraph UDG_11(6);
+    UDG_11.addEdges({ {1, 6}, {6, 2}, {2, 5}, {5, 3}, {3, 4} });
+    UDG_11.reorderRCM();
+    UDG_11.printGraph();
+    UDG_11.printAdjMatrix();
+
+    //    : -""   ,
+    //      
+    random_device rd;
+    mt19937 gen(rd());
+    ofstream fout("reorder_results.csv");
+    fout << "N;Order;AvgGap;BFS_List(ms);BFS_CSR(ms);PageRank(ms)\n";
+    volatile double sink = 0; //      
+
+    for (int N : {10000, 100000, 500000}) {
+        vector<int> scramble(N + 1);
+        iota(scramble.begin(), scramble.end(), 0);
+        shuffle(scramble.begin() + 1, scramble.end(), gen);
+        uniform_int_distribution<> vertex(1, N);
+        vector<pair<int, int>> edges;
+        for (int i = 1; i <= N; i++) {
+            for (int d = 1; d <= 4 && i + d <= N; d++) edges.push_back({ scramble[i], scramble[i + d] });
+        }
+        for (int i = 0; i < N / 2; i++) edges.push_back({ vertex(gen), vertex(gen) });
+
+        for (string order : {"Original", "Degree", "RCM", "Community"}) {
+            UndirectedGraph G(N);
+            G.addEdges(edges);
+            if (order == "Degree") G.reorderByDegree();
+            else if (order == "RCM") G.reorderRCM();
+            else if (order == "Community") G.reorderByCommunity();
+            vector<int> offsets, targets;
+            G.toCSR(offsets, targets);
+
+            // ~~~BFS   ~~~
+            double bfs_list = medianTime([&] { sink = sink + G.bfsSweep(); }, 21);
+
+            // ~~~BFS  CSR~~~
+            double bfs_csr = medianTime([&] { sink = sink + bfsSweep(offsets, targets); }, 21);
+
+            // ~~~PageRank ( )~~~
+            double pr = medianTime([&] { sink = sink + pageRankSweep(offsets, targets, 1); }, 21);
+
+            fout << N << ";" << order << ";" << averageGap(offsets, targets) << ";" << bfs_list << ";" << bfs_csr << ";" << pr << "\n";
+        }
+        cout << "N=" << N << " done\n";
+    }
+    fout.close();
+
+#ifdef AA_STATS
+    stats::dumpJSON("stats.json");
+#endif
 }
\ No newline at end of file